@@ -4045,6 +4045,11 @@ namespace IGC
             SaveOption(vISA_TotalGRFNum, context->getNumGRFPerThread());
         }
 
+        if (IGC_GET_FLAG_VALUE(VISACompileThreads) > 1)
+        {
+            SaveOption(vISA_NumCompileThreads, IGC_GET_FLAG_VALUE(VISACompileThreads));
+        }
+
 
 
         if (IGC_IS_FLAG_ENABLED(SystemThreadEnable))
@@ -5228,7 +5233,14 @@ namespace IGC
         else
         {
             pMainKernel = vMainKernel;
-            vIsaCompile = vbuilder->Compile(m_enableVISAdump ? GetDumpFileName("isa").c_str() : "");
+            if (m_pendingCompile.valid())
+            {
+                vIsaCompile = m_pendingCompile.get();
+            }
+            else
+            {
+                vIsaCompile = vbuilder->Compile(m_enableVISAdump ? GetDumpFileName("isa").c_str() : "");
+            }
         }
 
         COMPILER_TIME_END(m_program->GetContext(), TIME_CG_vISACompile);
@@ -5483,8 +5495,38 @@ namespace IGC
         pOutput->m_numGRFTotal = jitInfo->numGRFTotal;
     }
 
+    bool CEncoder::CanCompileAsync()
+    {
+        // Inline asm and .visaasm overrides are re-parsed by the vISA text
+        // reader, whose lexer/parser state is global and not thread safe.
+        // Code patch candidates are consumed by the next SIMD variant.
+        return !m_hasInlineAsm &&
+            !IsCodePatchCandidate() &&
+            IGC_IS_FLAG_DISABLED(ShaderOverride);
+    }
+
+    void CEncoder::CompileAsync()
+    {
+        IGC_ASSERT(CanCompileAsync());
+        IGC_ASSERT(!m_pendingCompile.valid());
+
+        // Each SIMD variant owns its builder, so the finalizer only touches
+        // per-builder state. Everything that reads back into the context is
+        // left to Compile() on the calling thread.
+        VISABuilder* builder = vbuilder;
+        std::string isaName = m_enableVISAdump ? GetDumpFileName("isa") : "";
+        m_pendingCompile = std::async(std::launch::async, [builder, isaName]()
+        {
+            return builder->Compile(isaName.c_str());
+        });
+    }
+
     void CEncoder::DestroyVISABuilder()
     {
+        if (m_pendingCompile.valid())
+        {
+            m_pendingCompile.wait();
+        }
         if (vAsmTextBuilder != nullptr)
         {
             V(::DestroyVISABuilder(vAsmTextBuilder));
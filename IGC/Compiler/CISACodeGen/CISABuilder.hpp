@@ -30,6 +30,7 @@ IN THE SOFTWARE.
 #include "Compiler/CISACodeGen/helper.h"
 #include "visa_wa.h"
 #include "inc/common/sku_wa.h"
+#include <future>
 
 namespace IGC
 {
@@ -149,6 +150,11 @@ namespace IGC
         void MarkAsOutput(CVariable* var);
         void MarkAsPayloadLiveOut(CVariable* var);
         void Compile(bool hasSymbolTable = false);
+        /// \brief Start the vISA finalizer on a worker thread. The result is
+        /// picked up by the next call to Compile().
+        void CompileAsync();
+        bool CanCompileAsync();
+        bool IsCompilePending() const { return m_pendingCompile.valid(); }
         std::string GetShaderName();
         void ReportCompilerStatistics(VISAKernel* pMainKernel, SProgramOutput* pOutput);
         int GetThreadCount(SIMDMode simdMode);
@@ -655,6 +661,9 @@ namespace IGC
         bool m_enableVISAdump;
         bool m_hasInlineAsm;
 
+        /// Return value of vbuilder->Compile() when it was started by CompileAsync()
+        std::future<int> m_pendingCompile;
+
         std::vector<VISA_LabelOpnd*> labelMap;
         std::vector<CName> labelNameMap; // parallel to labelMap
 
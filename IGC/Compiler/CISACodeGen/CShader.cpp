@@ -3293,6 +3293,41 @@ bool CShader::CompileSIMDSizeInCommon(SIMDMode simdMode)
     return ret;
 }
 
+CShader::SIMDDecision CShader::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
+{
+    m_queuedSIMDInfo.clear();
+    SIMDDecision decision = DecideSIMDSize(simdMode, EP, F);
+    if (decision != SIMDDecision::Pending)
+    {
+        for (const QueuedSIMDInfo& info : m_queuedSIMDInfo)
+        {
+            if (info.clear)
+                m_ctx->ClearSIMDInfo(info.simd, info.mode);
+            else
+                m_ctx->SetSIMDInfo(info.bit, info.simd, info.mode);
+        }
+    }
+    m_queuedSIMDInfo.clear();
+    return decision;
+}
+
+void CShader::QueueSIMDInfo(SIMDInfoBit bit, SIMDMode simd, ShaderDispatchMode mode)
+{
+    m_queuedSIMDInfo.push_back({ false, bit, simd, mode });
+}
+
+void CShader::QueueClearSIMDInfo(SIMDMode simd, ShaderDispatchMode mode)
+{
+    m_queuedSIMDInfo.push_back({ true, SIMD_SELECTED, simd, mode });
+}
+
+bool CShader::IsResultPending(CShader* other)
+{
+    return !m_finishingPendingCompiles &&
+        other != nullptr && other != this &&
+        other->GetEncoder().IsCompilePending();
+}
+
 CShader* CShaderProgram::GetShader(SIMDMode simd, ShaderDispatchMode mode)
 {
     return GetShaderPtr(simd, mode);
@@ -424,10 +424,10 @@ namespace IGC
 
     // CS codegen passes is added with below order:
     //   simd16, simd32, simd8
-    bool CComputeShader::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
+    CShader::SIMDDecision CComputeShader::DecideSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
     {
         if (!CompileSIMDSizeInCommon(simdMode))
-            return false;
+            return SIMDDecision::Skip;
 
         // this can be changed to SIMD32 if that is better after testing on HW
         static const SIMDMode BestSimdMode = SIMDMode::SIMD16;
@@ -438,6 +438,14 @@ namespace IGC
         CShader* simd16Program = getSIMDEntry(ctx, SIMDMode::SIMD16);
         CShader* simd32Program = getSIMDEntry(ctx, SIMDMode::SIMD32);
 
+        // With EnableParallelSIMDCompile an earlier variant may still be in
+        // the finalizer. The rules below read its results, so leave the
+        // decision to SIMDCompileJoinPass.
+        bool otherPending =
+            IsResultPending(simd8Program) ||
+            IsResultPending(simd16Program) ||
+            IsResultPending(simd32Program);
+
         bool hasSimd8 = simd8Program && simd8Program->ProgramOutput()->m_programSize > 0;
         bool hasSimd16 = simd16Program && simd16Program->ProgramOutput()->m_programSize > 0;
         bool hasSimd32 = simd32Program && simd32Program->ProgramOutput()->m_programSize > 0;
@@ -449,13 +457,18 @@ namespace IGC
         // if already has an entry from previous compilation, then skip
         if (ctx->m_retryManager.GetSIMDEntry(simdMode) != nullptr)
         {
-            return false;
+            return SIMDDecision::Skip;
         }
 
         if (!ctx->m_retryManager.IsFirstTry())
         {
-            ctx->ClearSIMDInfo(simdMode, ShaderDispatchMode::NOT_APPLICABLE);
-            ctx->SetSIMDInfo(SIMD_RETRY, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+            QueueClearSIMDInfo(simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+            QueueSIMDInfo(SIMD_RETRY, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+        }
+
+        if (otherPending)
+        {
+            return SIMDDecision::Pending;
         }
 
 
@@ -463,8 +476,8 @@ namespace IGC
         if (simdMode == SIMDMode::SIMD32 && simd16Program &&
             simd16Program->m_spillSize > 0)
         {
-            ctx->SetSIMDInfo(SIMD_SKIP_SPILL, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
-            return false;
+            QueueSIMDInfo(SIMD_SKIP_SPILL, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+            return SIMDDecision::Skip;
         }
 
         if (hasSimd16)  // got simd16 kernel, see whether compile simd32/simd8
@@ -487,7 +500,7 @@ namespace IGC
                         threadGroupSize_Y == 32 &&
                         threadGroupSize_Z == 1))
                 {
-                    return true;
+                    return SIMDDecision::Compile;
                 }
 
                 float occu16 = ctx->GetThreadOccupancy(SIMDMode::SIMD16);
@@ -496,27 +509,27 @@ namespace IGC
                     (occu32 > occu16 ||
                     (occu32 == occu16 && ctx->m_instrTypes.hasBarrier)))
                 {
-                    return true;
+                    return SIMDDecision::Compile;
                 }
 
-                ctx->SetSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                QueueSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
             }
             else    // SIMD8
             {
                 if (simd16Program->m_spillCost <= ctx->GetSpillThreshold())
                 {
-                    ctx->SetSIMDInfo(SIMD_SKIP_PERF, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
-                    return false;
+                    QueueSIMDInfo(SIMD_SKIP_PERF, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    return SIMDDecision::Skip;
                 }
                 else if (!ctx->m_retryManager.IsLastTry() && ctx->instrStat[LICM_STAT][EXCEED_THRESHOLD])
                 {
                     // skip SIMD8 if LICM threshold is met, unless it's lastTry
-                    ctx->SetSIMDInfo(SIMD_SKIP_REGPRES, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
-                    return false;
+                    QueueSIMDInfo(SIMD_SKIP_REGPRES, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    return SIMDDecision::Skip;
                 }
                 else
                 {
-                    return true;
+                    return SIMDDecision::Compile;
                 }
             }
         }
@@ -527,12 +540,12 @@ namespace IGC
         {
             if (IGC_IS_FLAG_ENABLED(EnableCSSIMD32) || BestSimdMode == SIMDMode::SIMD32)
             {
-                return true;
+                return SIMDDecision::Compile;
             }
             if (m_threadGroupSize >= 256 && m_hasSLM &&
                 !ctx->m_threadCombiningOptDone && !ctx->m_IsPingPongSecond)
             {
-                return true;
+                return SIMDDecision::Compile;
             }
         }
 
@@ -542,22 +555,22 @@ namespace IGC
         if ((simdMode == SIMDMode::SIMD8 && hasSimd8) ||
             (simdMode == SIMDMode::SIMD16 && hasSimd16))
         {
-            return false;
+            return SIMDDecision::Skip;
         }
         else
             if (simdMode == SIMDMode::SIMD32)
             {
                 if (hasSimd32 || ctx->isSecondCompile)
                 {
-                    return false;
+                    return SIMDDecision::Skip;
                 }
 
                 if ((hasSimd8 || hasSimd16) && BestSimdMode != SIMDMode::SIMD32)
                 {
-                    return false;
+                    return SIMDDecision::Skip;
                 }
             }
 
-        return true;
+        return SIMDDecision::Compile;
     }
 }
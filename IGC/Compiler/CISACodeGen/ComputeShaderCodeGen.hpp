@@ -36,7 +36,7 @@ namespace IGC
 
         void        AllocatePayload() override;
         void        AddPrologue() override;
-        bool        CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F) override;
+        SIMDDecision DecideSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F) override;
         void        InitEncoder(SIMDMode simdMode, bool canAbortOnSpill, ShaderDispatchMode shaderMode = ShaderDispatchMode::NOT_APPLICABLE) override;
 
         void        FillProgram(SComputeShaderKernelProgram* pKernelProgram);
@@ -528,6 +528,61 @@ void EmitPass::CreateKernelShaderMap(CodeGenContext* ctx, MetaDataUtils* pMdUtil
     }
 }
 
+// Disable mid-thread preemption for short, loop-free compute kernels.
+static void DisableMidThreadPreemptionIfShort(CShader* pShader)
+{
+    if ((pShader->GetShaderType() == ShaderType::COMPUTE_SHADER ||
+        pShader->GetShaderType() == ShaderType::OPENCL_SHADER) &&
+        pShader->m_Platform->supportDisableMidThreadPreemptionSwitch() &&
+        IGC_IS_FLAG_ENABLED(EnableDisableMidThreadPreemptionOpt) &&
+        (pShader->GetContext()->m_instrTypes.numLoopInsts == 0) &&
+        (pShader->ProgramOutput()->m_InstructionCount < IGC_GET_FLAG_VALUE(MidThreadPreemptionDisableThreshold)))
+    {
+        if (pShader->GetShaderType() == ShaderType::COMPUTE_SHADER)
+        {
+            CComputeShader* csProgram = static_cast<CComputeShader*>(pShader);
+            csProgram->SetDisableMidthreadPreemption();
+        }
+        else
+        {
+            COpenCLKernel* kernel = static_cast<COpenCLKernel*>(pShader);
+            kernel->SetDisableMidthreadPreemption();
+        }
+    }
+}
+
+// Finish the vISA compiles that EmitPass handed to worker threads, in
+// emission order, so every variant is decided on the same state a serial
+// compile would see.
+static void FinishPendingCompiles(CShaderProgram* pProgram)
+{
+    for (auto& pending : pProgram->m_pendingCompiles)
+    {
+        CShader* pShader = pending.shader;
+        CEncoder& encoder = pShader->GetEncoder();
+        IGC_ASSERT(encoder.IsCompilePending());
+
+        bool compile = true;
+        if (pending.decisionPending)
+        {
+            // The variants emitted before this one are finished now.
+            pShader->m_finishingPendingCompiles = true;
+            CShader::SIMDDecision decision = pShader->CompileSIMDSize(
+                pShader->m_dispatchSize, *pending.emitter, *pShader->entry);
+            pShader->m_finishingPendingCompiles = false;
+            IGC_ASSERT(decision != CShader::SIMDDecision::Pending);
+            compile = decision == CShader::SIMDDecision::Compile;
+        }
+        if (compile)
+        {
+            encoder.Compile(IGC::isIntelSymbolTableVoidProgram(pShader->entry));
+            DisableMidThreadPreemptionIfShort(pShader);
+        }
+        encoder.DestroyVISABuilder();
+    }
+    pProgram->m_pendingCompiles.clear();
+}
+
 bool EmitPass::runOnFunction(llvm::Function& F)
 {
     m_currFuncHasSubroutine = false;
@@ -620,10 +675,14 @@ bool EmitPass::runOnFunction(llvm::Function& F)
         m_currShader->InitEncoder(m_SimdMode, m_canAbortOnSpill, m_ShaderDispatchMode);
         // Pre-analysis pass to be executed before call to visa builder so we can pass scratch space offset
         m_currShader->PreAnalysisPass();
-        if (!m_currShader->CompileSIMDSize(m_SimdMode, *this, F))
+        CShader::SIMDDecision decision = m_currShader->CompileSIMDSize(m_SimdMode, *this, F);
+        if (decision == CShader::SIMDDecision::Skip)
         {
             return false;
         }
+        // Emit speculatively; the decision is made once the variants it
+        // depends on have been finished.
+        m_simdDecisionPending = decision == CShader::SIMDDecision::Pending;
 
         VISAKernel* prevKernel = nullptr;
 
@@ -738,10 +797,12 @@ bool EmitPass::runOnFunction(llvm::Function& F)
     }
     else
     {
-        if (!m_currShader->CompileSIMDSize(m_SimdMode, *this, F))
+        CShader::SIMDDecision decision = m_currShader->CompileSIMDSize(m_SimdMode, *this, F);
+        if (decision == CShader::SIMDDecision::Skip)
         {
             return false;
         }
+        m_simdDecisionPending |= decision == CShader::SIMDDecision::Pending;
         m_currShader->BeginFunction(&F);
         if (m_FGA && m_FGA->useStackCall(&F))
         {
@@ -1045,6 +1106,30 @@ bool EmitPass::runOnFunction(llvm::Function& F)
         {
             compileWithSymbolTable = true;
         }
+        if (m_pCtx->m_parallelSIMDCompile &&
+            !hasStackCall &&
+            !m_currShader->GetDebugInfoData() &&
+            m_encoder->CanCompileAsync())
+        {
+            // Let the finalizer run while the remaining SIMD variants are
+            // emitted; SIMDCompileJoinPass finishes this shader.
+            m_encoder->CompileAsync();
+            m_shaders[currHead]->m_pendingCompiles.push_back({ m_currShader, this, m_simdDecisionPending });
+            m_pCtx->m_prevShader = nullptr;
+            return false;
+        }
+        if (m_simdDecisionPending)
+        {
+            // This variant has to be compiled here, so finish the ones its
+            // SIMD heuristics are waiting for and decide now.
+            FinishPendingCompiles(m_shaders[currHead]);
+            if (m_currShader->CompileSIMDSize(m_SimdMode, *this, *currHead) == CShader::SIMDDecision::Skip)
+            {
+                m_encoder->DestroyVISABuilder();
+                m_pCtx->m_prevShader = nullptr;
+                return false;
+            }
+        }
         m_encoder->Compile(compileWithSymbolTable);
         m_pCtx->m_prevShader = m_currShader;
         // if we are doing stack-call, do the following:
@@ -1079,24 +1164,7 @@ bool EmitPass::runOnFunction(llvm::Function& F)
         }
     }
 
-    if ((m_currShader->GetShaderType() == ShaderType::COMPUTE_SHADER ||
-        m_currShader->GetShaderType() == ShaderType::OPENCL_SHADER) &&
-        m_currShader->m_Platform->supportDisableMidThreadPreemptionSwitch() &&
-        IGC_IS_FLAG_ENABLED(EnableDisableMidThreadPreemptionOpt) &&
-        (m_currShader->GetContext()->m_instrTypes.numLoopInsts == 0) &&
-        (m_currShader->ProgramOutput()->m_InstructionCount < IGC_GET_FLAG_VALUE(MidThreadPreemptionDisableThreshold)))
-    {
-        if (m_currShader->GetShaderType() == ShaderType::COMPUTE_SHADER)
-        {
-            CComputeShader* csProgram = static_cast<CComputeShader*>(m_currShader);
-            csProgram->SetDisableMidthreadPreemption();
-        }
-        else
-        {
-            COpenCLKernel* kernel = static_cast<COpenCLKernel*>(m_currShader);
-            kernel->SetDisableMidthreadPreemption();
-        }
-    }
+    DisableMidThreadPreemptionIfShort(m_currShader);
 
     // Temp WA to disable MTP when stack calls are present
     // TODO: Remove when VISA is fixed to copy R0 to dedicated register, so R0 contents won't be corrupted by MTP
@@ -1115,19 +1183,46 @@ bool EmitPass::runOnFunction(llvm::Function& F)
         this->m_ShaderDispatchMode == ShaderDispatchMode::NOT_APPLICABLE &&
         IsStage1BestPerf(m_pCtx->m_CgFlag, m_pCtx->m_StagingCtx))
     {
-        m_pCtx->m_doSimd32Stage2 = m_currShader->CompileSIMDSize(SIMDMode::SIMD32, *this, F);
+        m_pCtx->m_doSimd32Stage2 = m_currShader->CompileSIMDSize(SIMDMode::SIMD32, *this, F) ==
+            CShader::SIMDDecision::Compile;
     }
 
     if (m_SimdMode == SIMDMode::SIMD8 &&
         IsStage1FastCompile(m_pCtx->m_CgFlag, m_pCtx->m_StagingCtx))
     {
-        m_pCtx->m_doSimd16Stage2 = m_currShader->CompileSIMDSize(SIMDMode::SIMD16, *this, F);
-        m_pCtx->m_doSimd32Stage2 = m_currShader->CompileSIMDSize(SIMDMode::SIMD32, *this, F);
+        m_pCtx->m_doSimd16Stage2 = m_currShader->CompileSIMDSize(SIMDMode::SIMD16, *this, F) ==
+            CShader::SIMDDecision::Compile;
+        m_pCtx->m_doSimd32Stage2 = m_currShader->CompileSIMDSize(SIMDMode::SIMD32, *this, F) ==
+            CShader::SIMDDecision::Compile;
     }
 
     return false;
 }
 
+char SIMDCompileJoinPass::ID = 0;
+
+SIMDCompileJoinPass::SIMDCompileJoinPass(CShaderProgram::KernelShaderMap& shaders)
+    : FunctionPass(ID),
+    m_shaders(shaders)
+{
+}
+
+bool SIMDCompileJoinPass::runOnFunction(llvm::Function& F)
+{
+    // Pending compiles are recorded on the group head once its tail is
+    // emitted, so drain everything rather than looking up F.
+    finishPendingCompiles();
+    return false;
+}
+
+void SIMDCompileJoinPass::finishPendingCompiles()
+{
+    for (auto& kv : m_shaders)
+    {
+        FinishPendingCompiles(kv.second);
+    }
+}
+
 // Emit code in slice starting from (reverse) iterator I. Return the iterator to
 // the next pattern to emit.
 SBasicBlock::reverse_iterator
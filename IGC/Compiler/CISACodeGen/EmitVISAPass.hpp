@@ -586,6 +586,9 @@ public:
     VariableReuseAnalysis* m_VRA = nullptr;
     ModuleMetaData* m_moduleMD = nullptr;
     bool m_canAbortOnSpill;
+    // The SIMD heuristics could not decide on the current variant yet; see
+    // CShader::SIMDDecision::Pending.
+    bool m_simdDecisionPending = false;
     PSSignature* const m_pSignature;
 
     // Debug info emitter
@@ -734,4 +737,33 @@ private:
 
 };
 
+/// Waits for the vISA compiles EmitPass handed off to worker threads
+/// (EnableParallelSIMDCompile) and finishes them in emission order, so that
+/// the SIMD selection that follows sees the same state as a serial compile.
+class SIMDCompileJoinPass : public llvm::FunctionPass
+{
+public:
+    static char ID;
+
+    SIMDCompileJoinPass(CShaderProgram::KernelShaderMap& shaders);
+
+    // Variants whose SIMD decision was pending are decided through the
+    // EmitPass that emitted them, so keep the analyses it queries alive.
+    virtual void getAnalysisUsage(llvm::AnalysisUsage& AU) const override
+    {
+        AU.addRequired<MetaDataUtilsWrapper>();
+        AU.addRequired<Simd32ProfitabilityAnalysis>();
+        AU.addRequired<CodeGenContextWrapper>();
+        AU.setPreservesAll();
+    }
+
+    virtual bool runOnFunction(llvm::Function& F) override;
+    virtual llvm::StringRef getPassName() const override { return "SIMDCompileJoinPass"; }
+
+private:
+    void finishPendingCompiles();
+
+    CShaderProgram::KernelShaderMap& m_shaders;
+};
+
 } // namespace IGC
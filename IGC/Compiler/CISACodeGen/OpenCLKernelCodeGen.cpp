@@ -2239,15 +2239,15 @@ namespace IGC
         return false;
     }
 
-    bool COpenCLKernel::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
+    CShader::SIMDDecision COpenCLKernel::DecideSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
     {
         if (!CompileSIMDSizeInCommon(simdMode))
-            return false;
+            return SIMDDecision::Skip;
 
         if (!m_Context->m_retryManager.IsFirstTry())
         {
-            m_Context->ClearSIMDInfo(simdMode, ShaderDispatchMode::NOT_APPLICABLE);
-            m_Context->SetSIMDInfo(SIMD_RETRY, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+            QueueClearSIMDInfo(simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+            QueueSIMDInfo(SIMD_RETRY, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
         }
 
 
@@ -2259,12 +2259,21 @@ namespace IGC
         {
             // Entered here means driver has requested a specific SIMD mode, which was forced in the regkey ForceOCLSIMDWidth.
             // We return the condition can we compile the given forcedSIMDSize with this simdMode?
-            return (
+            bool compile =
                 // These statements are basically equivalent to (simdMode == forcedSIMDSize)
                 (simdMode == SIMDMode::SIMD8 && m_Context->getModuleMetaData()->csInfo.forcedSIMDSize == 8)   ||
                 (simdMode == SIMDMode::SIMD16 && m_Context->getModuleMetaData()->csInfo.forcedSIMDSize == 16) ||
-                (simdMode == SIMDMode::SIMD32 && m_Context->getModuleMetaData()->csInfo.forcedSIMDSize == 32)
-            );
+                (simdMode == SIMDMode::SIMD32 && m_Context->getModuleMetaData()->csInfo.forcedSIMDSize == 32);
+            return compile ? SIMDDecision::Compile : SIMDDecision::Skip;
+        }
+
+        // checkSIMDCompileConds looks at the variants compiled so far; with
+        // EnableParallelSIMDCompile they may still be in the finalizer.
+        if (IsResultPending(m_parent->GetShader(SIMDMode::SIMD8)) ||
+            IsResultPending(m_parent->GetShader(SIMDMode::SIMD16)) ||
+            IsResultPending(m_parent->GetShader(SIMDMode::SIMD32)))
+        {
+            return SIMDDecision::Pending;
         }
 
         SIMDStatus simdStatus = checkSIMDCompileConds(simdMode, EP, F);
@@ -2272,22 +2281,22 @@ namespace IGC
 
         // Func and Perf checks pass, compile this SIMD
         if (simdStatus == SIMDStatus::SIMD_PASS)
-            return true;
+            return SIMDDecision::Compile;
 
         // Functional failure, skip compiling this SIMD
         if (simdStatus == SIMDStatus::SIMD_FUNC_FAIL)
-            return false;
+            return SIMDDecision::Skip;
 
         IGC_ASSERT(simdStatus == SIMDStatus::SIMD_PERF_FAIL);
         //not profitable
         if (m_Context->m_DriverInfo.sendMultipleSIMDModes())
         {
             if (EP.m_canAbortOnSpill)
-                return false; //not the first functionally correct SIMD, exit
+                return SIMDDecision::Skip; //not the first functionally correct SIMD, exit
             else
-                return true; //is the first functionally correct SIMD, compile
+                return SIMDDecision::Compile; //is the first functionally correct SIMD, compile
         }
-        return simdStatus == SIMDStatus::SIMD_PASS;
+        return simdStatus == SIMDStatus::SIMD_PASS ? SIMDDecision::Compile : SIMDDecision::Skip;
     }
 
 
@@ -2339,7 +2348,7 @@ namespace IGC
 
             if (!canCompile)
             {
-                pCtx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                QueueSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                 return SIMDStatus::SIMD_FUNC_FAIL;
             }
         }
@@ -2350,7 +2359,7 @@ namespace IGC
             // Fail on SIMD32 for all groups with function calls
             if (simdMode == SIMDMode::SIMD32)
             {
-                pCtx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                QueueSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                 return SIMDStatus::SIMD_FUNC_FAIL;
             }
             // Group has no stackcalls, is not the SymbolTable dummy kernel, and subgroup size is not set
@@ -2360,7 +2369,7 @@ namespace IGC
                 simd_size == 0 &&
                 simdMode != SIMDMode::SIMD8)
             {
-                pCtx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                QueueSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                 return SIMDStatus::SIMD_FUNC_FAIL;
             }
         }
@@ -2388,14 +2397,14 @@ namespace IGC
             case 8:
                 if (simdMode != SIMDMode::SIMD8)
                 {
-                    pCtx->SetSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    QueueSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                     return SIMDStatus::SIMD_FUNC_FAIL;
                 }
                 break;
             case 16:
                 if (simdMode != SIMDMode::SIMD16)
                 {
-                    pCtx->SetSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    QueueSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                     return SIMDStatus::SIMD_FUNC_FAIL;
                 }
                 EP.m_canAbortOnSpill = false;
@@ -2403,7 +2412,7 @@ namespace IGC
             case 32:
                 if (simdMode != SIMDMode::SIMD32)
                 {
-                    pCtx->SetSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    QueueSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                     return SIMDStatus::SIMD_FUNC_FAIL;
                 }
                 else {
@@ -2442,7 +2451,7 @@ namespace IGC
                 if (simdMode == SIMDMode::SIMD32 ||
                     (groupSize <= 8 && simdMode != SIMDMode::SIMD8))
                 {
-                    pCtx->SetSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    QueueSIMDInfo(SIMD_SKIP_THGRPSIZE, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                     return SIMDStatus::SIMD_FUNC_FAIL;
                 }
             }
@@ -2461,7 +2470,7 @@ namespace IGC
                 Simd32ProfitabilityAnalysis& PA = EP.getAnalysis<Simd32ProfitabilityAnalysis>();
                 if (!PA.isSimd16Profitable())
                 {
-                    pCtx->SetSIMDInfo(SIMD_SKIP_PERF, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    QueueSIMDInfo(SIMD_SKIP_PERF, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                     return SIMDStatus::SIMD_PERF_FAIL;
                 }
             }
@@ -2478,7 +2487,7 @@ namespace IGC
                 Simd32ProfitabilityAnalysis& PA = EP.getAnalysis<Simd32ProfitabilityAnalysis>();
                 if (!PA.isSimd32Profitable())
                 {
-                    pCtx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
+                    QueueSIMDInfo(SIMD_SKIP_HW, simdMode, ShaderDispatchMode::NOT_APPLICABLE);
                     return SIMDStatus::SIMD_PERF_FAIL;
                 }
             }
@@ -46,7 +46,7 @@ namespace IGC
         void ExtractGlobalVariables() override {}
 
         bool        hasReadWriteImage(llvm::Function& F) override;
-        bool        CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F) override;
+        SIMDDecision DecideSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F) override;
         SIMDStatus  checkSIMDCompileConds(SIMDMode simdMode, EmitPass& EP, llvm::Function& F);
 
         void        FillKernel();
@@ -1246,17 +1246,17 @@ CVariable* CPixelShader::GetCurrentPhaseCounter()
 }
 
 
-bool CPixelShader::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
+CShader::SIMDDecision CPixelShader::DecideSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
 {
     if (!CompileSIMDSizeInCommon(simdMode))
-        return false;
+        return SIMDDecision::Skip;
 
 
     CodeGenContext* ctx = GetContext();
     if (!ctx->m_retryManager.IsFirstTry())
     {
-        ctx->ClearSIMDInfo(simdMode, EP.m_ShaderDispatchMode);
-        ctx->SetSIMDInfo(SIMD_RETRY, simdMode, EP.m_ShaderDispatchMode);
+        QueueClearSIMDInfo(simdMode, EP.m_ShaderDispatchMode);
+        QueueSIMDInfo(SIMD_RETRY, simdMode, EP.m_ShaderDispatchMode);
     }
 
     bool forceSIMD32 =
@@ -1270,37 +1270,37 @@ bool CPixelShader::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Functi
     if ((simdMode == SIMDMode::SIMD8  && AvoidDupStage2(8 , ctx->m_CgFlag, ctx->m_StagingCtx)) ||
         (simdMode == SIMDMode::SIMD16 && AvoidDupStage2(16, ctx->m_CgFlag, ctx->m_StagingCtx)))
     {
-        return false;
+        return SIMDDecision::Skip;
     }
 
     if (ctx->PsHighSimdDisable)
     {
         if (simdMode == SIMDMode::SIMD32)
-            return false;
+            return SIMDDecision::Skip;
     }
 
     if (m_HasoStencil && !ctx->platform.supportsStencil(simdMode))
     {
-        ctx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
-        return false;
+        QueueSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
+        return SIMDDecision::Skip;
     }
     if (m_HasDouble && simdMode != SIMDMode::SIMD8)
     {
-        ctx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
-        return false;
+        QueueSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
+        return SIMDDecision::Skip;
     }
     if (m_hasDualBlendSource && simdMode != SIMDMode::SIMD8 &&
         (m_phase == PSPHASE_PIXEL || ((m_phase != PSPHASE_LEGACY) && (ctx->platform.getWATable().Wa_1409392000 || ctx->platform.getPlatformInfo().eProductFamily == IGFX_ICELAKE))))
     {
         // Spec restriction CPS multi-phase cannot use SIMD16 with dual source blending
-        ctx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
-        return false;
+        QueueSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
+        return SIMDDecision::Skip;
     }
     if (m_phase != PSPHASE_LEGACY &&
         simdMode == SIMDMode::SIMD32)
     {
-        ctx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
-        return false;
+        QueueSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
+        return SIMDDecision::Skip;
     }
 
     if (GetContext()->platform.hasFusedEU() &&
@@ -1308,56 +1308,64 @@ bool CPixelShader::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Functi
         IsPerSample() && !IsStage1(ctx))
     {
         //Fused SIMD32 not enabled when dispatch rate is per sample
-        ctx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
-        return false;
+        QueueSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
+        return SIMDDecision::Skip;
     }
 
     if (simdMode == SIMDMode::SIMD16 && EP.m_ShaderDispatchMode == ShaderDispatchMode::NOT_APPLICABLE)
     {
         if (IsStage1BestPerf(ctx->m_CgFlag, ctx->m_StagingCtx))
         {
-            return true;
+            return SIMDDecision::Compile;
         }
         if (DoSimd16Stage2(ctx->m_StagingCtx))
         {
-            return true;
+            return SIMDDecision::Compile;
         }
 
         if (IGC_IS_FLAG_ENABLED(ForceBestSIMD))
         {
-            return true;
+            return SIMDDecision::Compile;
         }
 
         if (forceSIMD16)
         {
-            return true;
+            return SIMDDecision::Compile;
         }
         CShader* simd8Program = m_parent->GetShader(SIMDMode::SIMD8);
+        if (IsResultPending(simd8Program))
+        {
+            return SIMDDecision::Pending;
+        }
         if (simd8Program != nullptr && simd8Program->ProgramOutput()->m_scratchSpaceUsedBySpills > 0)
         {
-            ctx->SetSIMDInfo(SIMD_SKIP_REGPRES, simdMode, EP.m_ShaderDispatchMode);
-            return false;
+            QueueSIMDInfo(SIMD_SKIP_REGPRES, simdMode, EP.m_ShaderDispatchMode);
+            return SIMDDecision::Skip;
         }
     }
     if (simdMode == SIMDMode::SIMD32)
     {
         if (DoSimd32Stage2(ctx->m_StagingCtx))
         {
-            return true;
+            return SIMDDecision::Compile;
         }
 
         if (forceSIMD32)
         {
-            return true;
+            return SIMDDecision::Compile;
         }
 
         CShader* simd16Program = m_parent->GetShader(SIMDMode::SIMD16);
+        if (IsResultPending(simd16Program))
+        {
+            return SIMDDecision::Pending;
+        }
         if ((simd16Program == nullptr ||
             simd16Program->ProgramOutput()->m_programBin == 0 ||
             simd16Program->ProgramOutput()->m_scratchSpaceUsedBySpills > 0))
         {
-            ctx->SetSIMDInfo(SIMD_SKIP_REGPRES, simdMode, EP.m_ShaderDispatchMode);
-            return false;
+            QueueSIMDInfo(SIMD_SKIP_REGPRES, simdMode, EP.m_ShaderDispatchMode);
+            return SIMDDecision::Skip;
         }
 
         const PixelShaderInfo& psInfo = ctx->getModuleMetaData()->psInfo;
@@ -1368,47 +1376,47 @@ bool CPixelShader::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Functi
             !ctx->platform.supportSimd32PerPixelPSWithNumSamples16() &&
             !IsPerSample())
         {
-            return false;
+            return SIMDDecision::Skip;
         }
 
         if (psInfo.ForceEnableSimd32) // UMD forced compilation of simd32.
         {
-            return true;
+            return SIMDDecision::Compile;
         }
 
         if (!ctx->platform.enablePSsimd32())
         {
-            ctx->SetSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
-            return false;
+            QueueSIMDInfo(SIMD_SKIP_HW, simdMode, EP.m_ShaderDispatchMode);
+            return SIMDDecision::Skip;
         }
 
         if (iSTD::BitCount(m_RenderTargetMask) > 1)
         {
             // don't compile SIMD32 for MRT as we may trash the render cache
-            ctx->SetSIMDInfo(SIMD_SKIP_PERF, simdMode, EP.m_ShaderDispatchMode);
-            return false;
+            QueueSIMDInfo(SIMD_SKIP_PERF, simdMode, EP.m_ShaderDispatchMode);
+            return SIMDDecision::Skip;
         }
 
         Simd32ProfitabilityAnalysis& PA = EP.getAnalysis<Simd32ProfitabilityAnalysis>();
         if (PA.isSimd32Profitable())
         {
-            return true;
+            return SIMDDecision::Compile;
         }
         else
         {
-            ctx->SetSIMDInfo(SIMD_SKIP_PERF, simdMode, EP.m_ShaderDispatchMode);
+            QueueSIMDInfo(SIMD_SKIP_PERF, simdMode, EP.m_ShaderDispatchMode);
         }
 
         if (simd16Program && static_cast<CPixelShader*>(simd16Program)->m_sendStallCycle == 0)
         {
             // simd16 doesn't have any latency issue, no need to try simd32
-            ctx->SetSIMDInfo(SIMD_SKIP_STALL, simdMode, EP.m_ShaderDispatchMode);
-            return false;
+            QueueSIMDInfo(SIMD_SKIP_STALL, simdMode, EP.m_ShaderDispatchMode);
+            return SIMDDecision::Skip;
         }
 
         if (ctx->platform.psSimd32SkipStallHeuristic() && ctx->m_DriverInfo.AlwaysEnableSimd32())
         {
-            return true;
+            return SIMDDecision::Compile;
         }
 
         if (simd16Program)
@@ -1417,16 +1425,16 @@ bool CPixelShader::CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Functi
             uint staticCycle = static_cast<CPixelShader*>(simd16Program)->m_staticCycle;
             if (sendStallCycle / (float)staticCycle > 0.4)
             {
-                return true;
+                return SIMDDecision::Compile;
             }
             else
             {
-                ctx->SetSIMDInfo(SIMD_SKIP_STALL, simdMode, EP.m_ShaderDispatchMode);
+                QueueSIMDInfo(SIMD_SKIP_STALL, simdMode, EP.m_ShaderDispatchMode);
             }
         }
-        return false;
+        return SIMDDecision::Skip;
     }
-    return true;
+    return SIMDDecision::Compile;
 }
 
 void linkProgram(const SProgramOutput& cps, const SProgramOutput& ps, SProgramOutput& linked)
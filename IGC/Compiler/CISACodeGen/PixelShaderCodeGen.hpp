@@ -82,7 +82,7 @@ public:
     void AddPrologue() override;
     void PreAnalysisPass() override;
     void AddEpilogue(llvm::ReturnInst* ret) override;
-    bool CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F) override;
+    SIMDDecision DecideSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F) override;
     void ExtractGlobalVariables() override;
 
     void        AllocatePSPayload();
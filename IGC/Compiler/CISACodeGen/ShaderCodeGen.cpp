@@ -866,6 +866,18 @@ static void AddCodeGenPasses(
     COMPILER_TIME_END(&ctx, TIME_CG_Add_CodeGen_Passes);
 }
 
+// Returns true if the vISA compile of each SIMD variant can be handed off to a
+// worker thread. The variants are then emitted speculatively and the SIMD
+// heuristics that depend on other variants are re-applied by
+// SIMDCompileJoinPass once all of them are done.
+static bool UseParallelSIMDCompile(CodeGenContext& ctx)
+{
+    return IGC_IS_FLAG_ENABLED(EnableParallelSIMDCompile) &&
+        IsAllSIMDs(ctx.m_CgFlag, ctx.m_StagingCtx) &&
+        IGC_IS_FLAG_DISABLED(ForceBestSIMD) &&
+        !ctx.m_instrTypes.hasDebugInfo;
+}
+
 // Adds Compute Shader CodeGen passes for all simd sizes required, used in
 // default case when no special registry keys are set.
 template<typename ContextType>
@@ -1040,6 +1052,7 @@ static void PSCodeGen(
     IGCPassManager PassMgr(ctx, "CG");
 
     COMPILER_TIME_START(ctx, TIME_CG_Add_Passes);
+    ctx->m_parallelSIMDCompile = UseParallelSIMDCompile(*ctx);
     AddLegalizationPasses(*ctx, PassMgr, pSignature);
     AddAnalysisPasses(*ctx, PassMgr);
 
@@ -1139,6 +1152,10 @@ static void PSCodeGen(
         }
     }
 
+    if (ctx->m_parallelSIMDCompile)
+    {
+        PassMgr.add(new SIMDCompileJoinPass(shaders));
+    }
     PassMgr.add(new DebugInfoPass(shaders));
     COMPILER_TIME_END(ctx, TIME_CG_Add_Passes);
 
@@ -1158,6 +1175,7 @@ void CodeGen(ComputeShaderContext* ctx, CShaderProgram::KernelShaderMap& shaders
     bool setEarlyExit16Stat = false;
 
     IGCPassManager PassMgr(ctx, "CG");
+    ctx->m_parallelSIMDCompile = UseParallelSIMDCompile(*ctx);
 
     AddLegalizationPasses(*ctx, PassMgr);
 
@@ -1187,6 +1205,11 @@ void CodeGen(ComputeShaderContext* ctx, CShaderProgram::KernelShaderMap& shaders
         AddCodeGenPasses(*ctx, shaders, PassMgr, simdModeAllowed, maxSimdMode, setEarlyExit16Stat);
     }
 
+    if (ctx->m_parallelSIMDCompile)
+    {
+        PassMgr.add(new SIMDCompileJoinPass(shaders));
+    }
+
     COMPILER_TIME_END(ctx, TIME_CG_Add_Passes);
 
     PassMgr.run(*(ctx->getModule()));
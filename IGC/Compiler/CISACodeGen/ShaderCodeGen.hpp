@@ -103,10 +103,24 @@ public:
         return nullptr;
     }
     virtual bool hasReadWriteImage(llvm::Function& F) { return false; }
-    virtual bool CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
+    /// Outcome of the SIMD heuristics for one variant. Pending means they need
+    /// the result of a variant that is still in the finalizer
+    /// (EnableParallelSIMDCompile); decide again in SIMDCompileJoinPass.
+    enum class SIMDDecision { Skip, Compile, Pending };
+    /// Run the SIMD heuristics for simdMode. They record SIMD info through
+    /// QueueSIMDInfo/QueueClearSIMDInfo instead of writing the context.
+    virtual SIMDDecision DecideSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F)
     {
-        return CompileSIMDSizeInCommon(simdMode);
+        return CompileSIMDSizeInCommon(simdMode) ? SIMDDecision::Compile : SIMDDecision::Skip;
     }
+    /// Decide on simdMode and, unless the decision is pending, write the SIMD
+    /// info it recorded to the context, so a variant that is decided again at
+    /// the join is accounted for once.
+    SIMDDecision CompileSIMDSize(SIMDMode simdMode, EmitPass& EP, llvm::Function& F);
+    /// Set by SIMDCompileJoinPass while it decides a variant: the variants it
+    /// has not finished yet were emitted later and, as in a serial compile,
+    /// have no result to look at.
+    bool m_finishingPendingCompiles = false;
     CVariable* LazyCreateCCTupleBackingVariable(
         CoalescingEngine::CCTuple* ccTuple,
         VISA_Type baseType = ISA_TYPE_UD);
@@ -492,7 +506,22 @@ public:
 protected:
     void GetPrintfStrings(std::vector<std::pair<unsigned int, std::string>>& printfStrings);
     bool CompileSIMDSizeInCommon(SIMDMode simdMode);
+    void QueueSIMDInfo(SIMDInfoBit bit, SIMDMode simd, ShaderDispatchMode mode);
+    void QueueClearSIMDInfo(SIMDMode simd, ShaderDispatchMode mode);
+    /// True if the SIMD heuristics cannot read the result of other yet
+    /// because its vISA compile is still running on a worker thread.
+    bool IsResultPending(CShader* other);
 private:
+    // SIMD info recorded by the running DecideSIMDSize; see CompileSIMDSize.
+    struct QueuedSIMDInfo
+    {
+        bool clear;
+        SIMDInfoBit bit;
+        SIMDMode simd;
+        ShaderDispatchMode mode;
+    };
+    llvm::SmallVector<QueuedSIMDInfo, 4> m_queuedSIMDInfo;
+
     // Return DefInst's CVariable if it could be reused for UseInst, and return
     // nullptr otherwise.
     CVariable* reuseSourceVar(llvm::Instruction* UseInst,
@@ -627,6 +656,17 @@ public:
     void FillProgram(SComputeShaderKernelProgram* pKernelProgram);
     void FillProgram(SOpenCLProgramInfo* pKernelProgram);
     ShaderStats* m_shaderStats;
+    // A SIMD variant whose vISA compile is running on a worker thread, with
+    // the EmitPass that emitted it. decisionPending is set if the SIMD
+    // heuristics returned SIMDDecision::Pending for it.
+    struct PendingCompile
+    {
+        CShader* shader;
+        EmitPass* emitter;
+        bool decisionPending;
+    };
+    // In emission order; drained by SIMDCompileJoinPass.
+    llvm::SmallVector<PendingCompile, 4> m_pendingCompiles;
 
 protected:
     CShader*& GetShaderPtr(SIMDMode simd, ShaderDispatchMode mode);
@@ -912,6 +912,9 @@ namespace IGC
         // pass it to Stage2.
         bool m_doSimd32Stage2 = false;
         bool m_doSimd16Stage2 = false;
+        // vISA compile of each SIMD variant is handed off to a worker thread
+        // and joined by SIMDCompileJoinPass (EnableParallelSIMDCompile).
+        bool m_parallelSIMDCompile = false;
         std::string m_savedBitcodeString;
         SInstrTypes m_savedInstrTypes;
 
@@ -50,6 +50,9 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <list>
 #include <string>
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 using namespace vISA;
 extern "C" int64_t getTimerTicks(unsigned int idx);
@@ -673,6 +676,48 @@ int CISA_IR_Builder::ParseVISAText(const std::string& visaFile)
 #endif
 }
 
+// Run compileFastPath() of the given kernels/functions on up to numThreads
+// worker threads. Each unit owns its G4_Kernel, IR_Builder and a private copy
+// of the options (see VISAKernelImpl::isolateOptions()). Decisions RA makes
+// for one unit are kept in its G4_Kernel in both modes, so the output matches
+// serial compilation. The status of the first failing unit in list order is
+// returned so that error reporting does not depend on thread timing.
+static int compileUnitsInParallel(
+    const std::vector<VISAKernelImpl*>& units, unsigned numThreads)
+{
+    std::vector<int> unitStatus(units.size(), VISA_SUCCESS);
+    std::atomic<size_t> nextUnit(0);
+    auto worker = [&]()
+    {
+        // timers are per-thread
+        initTimer();
+        for (size_t i = nextUnit++; i < units.size(); i = nextUnit++)
+        {
+            unitStatus[i] = units[i]->compileFastPath();
+        }
+    };
+
+    numThreads = std::min(numThreads, (unsigned)units.size());
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < numThreads; i++)
+    {
+        workers.emplace_back(worker);
+    }
+    for (auto& t : workers)
+    {
+        t.join();
+    }
+
+    for (int status : unitStatus)
+    {
+        if (status != VISA_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return VISA_SUCCESS;
+}
+
 // default size of the kernel mem manager in bytes
 #define KERNEL_MEM_SIZE    (4*1024*1024)
 int CISA_IR_Builder::Compile(const char* nameInput, std::ostream* os, bool emit_visa_only)
@@ -777,6 +822,15 @@ int CISA_IR_Builder::Compile(const char* nameInput, std::ostream* os, bool emit_
         unsigned int k = 0;
         bool isInPatchingMode = m_options.getuInt32Option(vISA_CodePatch) >= CodePatch_Enable_NoLTO && m_prevKernel;
         VISAKernelImpl* mainKernel = nullptr;
+        // Kernels and functions are optimized and register allocated independently
+        // until stitching, so that part may run on a thread pool. Payload sections
+        // (code patch mode) copy the main kernel's compiled declares, so they are
+        // always compiled in order.
+        unsigned numCompileThreads = m_options.getuInt32Option(vISA_NumCompileThreads);
+        bool compileInParallel = numCompileThreads > 1 &&
+            m_options.getuInt32Option(vISA_CodePatch) == 0 &&
+            m_kernelsAndFunctions.size() > 1;
+        std::vector<VISAKernelImpl*> unitsToCompile;
         for (iter = m_kernelsAndFunctions.begin(), i = 0; iter != end; iter++, i++)
         {
             VISAKernelImpl* kernel = (*iter);
@@ -829,6 +883,12 @@ int CISA_IR_Builder::Compile(const char* nameInput, std::ostream* os, bool emit_
             {
                 continue;
             }
+            if (compileInParallel)
+            {
+                kernel->isolateOptions();
+                unitsToCompile.push_back(kernel);
+                continue;
+            }
             int status =  kernel->compileFastPath();
             if (status != VISA_SUCCESS)
             {
@@ -836,6 +896,15 @@ int CISA_IR_Builder::Compile(const char* nameInput, std::ostream* os, bool emit_
                 return status;
             }
         }
+        if (compileInParallel)
+        {
+            int status = compileUnitsInParallel(unitsToCompile, numCompileThreads);
+            if (status != VISA_SUCCESS)
+            {
+                stopTimer(TimerID::TOTAL);
+                return status;
+            }
+        }
         // Here we change the payload section as the main kernel in m_kernelsAndFunctions
         // During stitching, all functions will be cloned and stitched to the main kernel.
         // Demoting the shader body to a function type makes it intact
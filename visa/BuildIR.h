@@ -477,6 +477,7 @@ public:
     std::vector<input_info_t*> m_inputVect;
 
     const Options* getOptions() const { return m_options; }
+    void           setOptions(Options *options) { m_options = options; }
     bool           getOption(vISAOptions opt) const {return m_options->getOption(opt); }
     uint32_t       getuint32Option(vISAOptions opt) const { return m_options->getuInt32Option(opt); }
     void           getOption(vISAOptions opt, const char *&str) const {return m_options->getOption(opt, str); }
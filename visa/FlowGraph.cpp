@@ -38,6 +38,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "iga/IGALibrary/api/iga.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
@@ -349,7 +350,8 @@ G4_BB* FlowGraph::createNewBBWithLabel(const char* LabelPrefix, int Lineno, int
     return newBB;
 }
 
-static int globalCount = 1;
+// shared by all builders; units may be compiled on several threads
+static std::atomic<int> globalCount(1);
 
 int64_t FlowGraph::insertDummyUUIDMov()
 {
@@ -368,8 +370,7 @@ int64_t FlowGraph::insertDummyUUIDMov()
         for (auto bb : BBs)
         {
             uint32_t seed = (uint32_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
-            std::mt19937 mt_rand(seed * globalCount);
-            globalCount++;
+            std::mt19937 mt_rand(seed * globalCount++);
 
             G4_DstRegRegion* nullDst = builder->createNullDst(Type_UD);
             int64_t uuID = (int64_t)mt_rand();
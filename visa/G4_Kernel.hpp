@@ -178,6 +178,12 @@ private:
 
     bool m_hasIndirectCall = false;
 
+    // RA fallbacks taken while compiling this kernel. They are kept here and
+    // not written to the options, which are shared with the other kernels and
+    // functions of the builder.
+    bool m_noLocalRA = false;
+    bool m_noSpillingLocalRA = false;
+
     VarSplitPass* varSplitPass = nullptr;
 
     // map key is filename string with complete path.
@@ -223,6 +229,7 @@ public:
     uint64_t getKernelID() const { return kernelID; }
 
     Options *getOptions() { return m_options; }
+    void setOptions(Options *options) { m_options = options; }
     const Attributes* getKernelAttrs() const { return m_kernelAttrs; }
     bool getBoolKernelAttr(Attributes::ID aID) const {
         return getKernelAttrs()->getBoolKernelAttr(aID);
@@ -310,6 +317,13 @@ public:
     bool hasIndirectCall() const {return m_hasIndirectCall;}
     void setHasIndirectCall() {m_hasIndirectCall = true;}
 
+    bool useLocalRA() const {return getOption(vISA_LocalRA) && !m_noLocalRA;}
+    void disableLocalRA() {m_noLocalRA = true;}
+    bool useHybridRAWithSpill() const {return getOption(vISA_HybridRAWithSpill) && !m_noSpillingLocalRA;}
+    bool useFastCompileRA() const {return getOption(vISA_FastCompileRA) && !m_noSpillingLocalRA;}
+    // turn off both local RA modes that may spill (HybridRAWithSpill, FastCompileRA)
+    void disableSpillingLocalRA() {m_noSpillingLocalRA = true;}
+
     RelocationTableTy& getRelocationTable() {
         return relocationTable;
     }
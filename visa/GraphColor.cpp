@@ -1203,7 +1203,7 @@ void GlobalRA::emitFGWithLiveness(const LivenessAnalysis& liveAnalysis) const
             DEBUG_VERBOSE("BB" << succ->getId() << ", ");
         }
 
-        if (kernel.getOption(vISA_LocalRA))
+        if (kernel.useLocalRA())
         {
             if (auto summary = kernel.fg.getBBLRASummary(bb))
             {
@@ -1884,7 +1884,7 @@ void Interference::markInterferenceForSend(G4_BB* bb,
             isDstRegAllocPartaker = true;
             dstId = ((G4_RegVar*)dstRgn->getBase())->getId();
         }
-        else if (kernel.getOption(vISA_LocalRA))
+        else if (kernel.useLocalRA())
         {
             LocalLiveRange* localLR = NULL;
             G4_Declare* topdcl = GetTopDclFromRegRegion(dst);
@@ -1939,7 +1939,7 @@ void Interference::markInterferenceForSend(G4_BB* bb,
                             }
                         }
                     }
-                    else if (kernel.getOption(vISA_LocalRA) && isDstRegAllocPartaker)
+                    else if (kernel.useLocalRA() && isDstRegAllocPartaker)
                     {
                         LocalLiveRange* localLR = nullptr;
                         const G4_Declare* topdcl = GetTopDclFromRegRegion(src);
@@ -1996,7 +1996,7 @@ void Interference::markInterferenceToAvoidDstSrcOverlap(G4_BB* bb,
             dstId = ((G4_RegVar*)dst->getBase())->getId();
             dstOpndNumRows = dst->getLinearizedEnd() - dst->getLinearizedStart() + 1 > numEltPerGRF<Type_UB>();
         }
-        else if (kernel.getOption(vISA_LocalRA))
+        else if (kernel.useLocalRA())
         {
             LocalLiveRange* localLR = NULL;
             G4_Declare* topdcl = GetTopDclFromRegRegion(dst);
@@ -2036,7 +2036,7 @@ void Interference::markInterferenceToAvoidDstSrcOverlap(G4_BB* bb,
                     int srcReg = 0;
                     bool isSrcEvenAlign = gra.isEvenAligned(srcDcl);
                     if (!src->asSrcRegRegion()->getBase()->isRegAllocPartaker() &&
-                        kernel.getOption(vISA_LocalRA))
+                        kernel.useLocalRA())
                     {
                         int sreg;
                         LocalLiveRange* localLR = NULL;
@@ -2096,7 +2096,7 @@ void Interference::markInterferenceToAvoidDstSrcOverlap(G4_BB* bb,
                                     }
                                 }
                             }
-                            else if (kernel.getOption(vISA_LocalRA) && isDstRegAllocPartaker)
+                            else if (kernel.useLocalRA() && isDstRegAllocPartaker)
                             {
                                 LocalLiveRange* localLR = NULL;
                                 G4_Declare* topdcl = GetTopDclFromRegRegion(src);
@@ -2517,7 +2517,7 @@ void Interference::computeInterference()
     //
     // Build interference with physical registers assigned by local RA
     //
-    if (kernel.getOption(vISA_LocalRA))
+    if (kernel.useLocalRA())
     {
         for (auto curBB : kernel.fg)
         {
@@ -4875,7 +4875,7 @@ void Augmentation::buildInteferenceForCallsite(FuncInfo* func)
             buildInteferenceForCallSiteOrRetDeclare(varDcl, &callsiteDeclares[func]);
         }
     }
-    if (kernel.getOption(vISA_LocalRA))
+    if (kernel.useLocalRA())
     {
         for (uint32_t j = 0; j < kernel.getNumRegTotal(); j++)
         {
@@ -4960,7 +4960,7 @@ void Augmentation::augmentIntfGraph()
         item.second.resize(liveAnalysis.getNumSelectedGlobalVar());
     }
 
-    if (kernel.getOption(vISA_LocalRA))
+    if (kernel.useLocalRA())
     {
         buildSummaryForCallees();
     }
@@ -6739,7 +6739,7 @@ bool GraphColor::regAlloc(
     {
         bool hasStackCall = kernel.fg.getHasStackCalls() || kernel.fg.getIsStackCallFunc();
 
-        bool willSpill = ((builder.getOption(vISA_FastCompileRA) || builder.getOption(vISA_HybridRAWithSpill)) && !hasStackCall) ||
+        bool willSpill = ((kernel.useFastCompileRA() || kernel.useHybridRAWithSpill()) && !hasStackCall) ||
             (kernel.getInt32KernelAttr(Attributes::ATTR_Target) == VISA_3D &&
             rpe->getMaxRP() >= kernel.getNumRegTotal() + 24);
         if (willSpill)
@@ -6770,9 +6770,10 @@ bool GraphColor::regAlloc(
                     if (!success && doBankConflictReduction)
                     {
                         resetTemporaryRegisterAssignments();
+                        bool enableBundleCR = kernel.getOption(vISA_enableBundleCR);
                         kernel.getOptions()->setOption(vISA_enableBundleCR, false);
                         assignColors(FIRST_FIT, false, false);
-                        kernel.getOptions()->setOption(vISA_enableBundleCR, true);
+                        kernel.getOptions()->setOption(vISA_enableBundleCR, enableBundleCR);
                     }
                 }
             }
@@ -8165,7 +8166,7 @@ void GlobalRA::detectUndefinedUses(LivenessAnalysis& liveAnalysis, G4_Kernel& ke
     {
         optreport << "=== Uses with reaching def - GRF ===" << std::endl;
     }
-    if (kernel.getOption(vISA_LocalRA))
+    if (kernel.useLocalRA())
     {
         optreport << "(Use -nolocalra switch for accurate results of uses without reaching defs)" << std::endl;
     }
@@ -9542,13 +9543,13 @@ int GlobalRA::coloringRegAlloc()
                 return VISA_SPILL;
             }
         }
-        else if (builder.getOption(vISA_LocalRA) && !hasStackCall)
+        else if (kernel.useLocalRA() && !hasStackCall)
         {
             copyMissingAlignment();
             BankConflictPass bc(*this);
             LocalRA lra(bc, *this);
             bool success = lra.localRA();
-            if (!success && !builder.getOption(vISA_HybridRAWithSpill))
+            if (!success && !kernel.useHybridRAWithSpill())
             {
                 if (canDoHRA(kernel))
                 {
@@ -9570,7 +9571,7 @@ int GlobalRA::coloringRegAlloc()
                 computePhyReg();
                 return VISA_SUCCESS;
             }
-            if (builder.getOption(vISA_HybridRAWithSpill))
+            if (kernel.useHybridRAWithSpill())
             {
                 insertPhyRegDecls();
             }
@@ -9600,7 +9601,7 @@ int GlobalRA::coloringRegAlloc()
     uint32_t sendAssociatedGRFSpillFillCount = 0;
     unsigned fastCompileIter = 1;
     bool fastCompile =
-        (builder.getOption(vISA_FastCompileRA) || builder.getOption(vISA_HybridRAWithSpill)) &&
+        (kernel.useFastCompileRA() || kernel.useHybridRAWithSpill()) &&
         !hasStackCall;
     if (fastCompile)
     {
@@ -9624,7 +9625,7 @@ int GlobalRA::coloringRegAlloc()
         }
         setIterNo(iterationNo);
 
-        if (!builder.getOption(vISA_HybridRAWithSpill))
+        if (!kernel.useHybridRAWithSpill())
         {
             resetGlobalRAStates();
         }
@@ -9637,7 +9638,7 @@ int GlobalRA::coloringRegAlloc()
         }
 
         //Identify the local variables to speedup following analysis
-        if (!builder.getOption(vISA_HybridRAWithSpill))
+        if (!kernel.useHybridRAWithSpill())
         {
             markGraphBlockLocalVars();
         }
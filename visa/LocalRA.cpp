@@ -179,7 +179,7 @@ void LocalRA::preLocalRAAnalysis()
     // Remove unreferenced dcls
     gra.removeUnreferencedDcls();
 
-    if (builder.getOption(vISA_HybridRAWithSpill) || builder.getOption(vISA_FastCompileRA))
+    if (kernel.useHybridRAWithSpill() || kernel.useFastCompileRA())
     {
         unsigned reserveSpillSize = 0;
         unsigned int spillRegSize = 0;
@@ -190,8 +190,7 @@ void LocalRA::preLocalRAAnalysis()
         reserveSpillSize = spillRegSize + indrSpillRegSize;
         if (reserveSpillSize >= kernel.getNumCalleeSaveRegs())
         {
-            const_cast<Options*>(builder.getOptions())->setOption(vISA_HybridRAWithSpill, false);
-            const_cast<Options*>(builder.getOptions())->setOption(vISA_FastCompileRA, false);
+            kernel.disableSpillingLocalRA();
             numRegLRA = numGRF - numRowsReserved;
         }
         else
@@ -588,6 +588,13 @@ Options::Options() {
     initialize_m_vISAOptions();
 }
 
+Options::Options(const Options& other) : Options() {
+    target = other.target;
+    stepping = other.stepping;
+    argString << other.argString.str();
+    m_vISAOptions.copyValues(other.m_vISAOptions);
+}
+
 Options::~Options() {
     ;
 }
@@ -130,6 +130,10 @@ class Options {
 
 public:
     Options();
+    // Deep copy; each value entry is duplicated so that the copy can be
+    // modified without affecting the original.
+    Options(const Options& other);
+    Options& operator=(const Options&) = delete;
     ~Options();
 
 public:
@@ -425,6 +429,32 @@ private:
             assert(Cstr && "Uninitialized?");
             return Cstr->getVal();
         }
+        // Copy the current values (and whether they are set by the user)
+        // of all options in OTHER
+        void copyValues(const VISAOptionsDB &other) {
+            for (auto &pair : other.optionsMap) {
+                vISAOptions key = pair.first;
+                switch (pair.second.type) {
+                case ET_BOOL:
+                    setBool(key, other.getBool(key));
+                    break;
+                case ET_INT32:
+                    setUint32(key, other.getUint32(key));
+                    break;
+                case ET_INT64:
+                case ET_2xINT32:
+                    setUint64(key, other.getUint64(key));
+                    break;
+                case ET_CSTR:
+                    setCstr(key, other.getCstr(key));
+                    break;
+                default:
+                    break;
+                }
+                optionsMap[key].argIsSet = pair.second.argIsSet;
+            }
+        }
+
         VISAOptionsDB() {}
         VISAOptionsDB(Options *opt) {
             options = opt;
@@ -863,6 +863,7 @@ public:
     }
 
     Options * getOptions() { return m_options; }
+    void isolateOptions();
 
     bool IsAsmWriterMode() const { return m_CISABuilder->getBuilderMode() == vISA_ASM_WRITER; }
 
@@ -1034,6 +1035,9 @@ private:
     void computeFCInfo();
     //memory managed by the entity that creates vISA Kernel object
     Options *m_options;
+    // private copy of the builder options used while compiling this kernel/function,
+    // owned by this object (see isolateOptions())
+    Options *m_unitOptions = nullptr;
 
     void createKernelAttributes() {
         void* pmem = m_mem.alloc(sizeof(vISA::Attributes));
@@ -575,6 +575,23 @@ int VISAKernelImpl::InitializeFastPath()
     return VISA_SUCCESS;
 }
 
+// Switch this kernel/function to a private copy of the builder options so it
+// can be compiled concurrently with the others. The few options still
+// written while compiling get the same value for every unit, so this only
+// keeps those writes off the shared copy; per-unit RA fallbacks live in the
+// G4_Kernel. Only used for parallel compilation.
+void VISAKernelImpl::isolateOptions()
+{
+    if (m_unitOptions)
+    {
+        return;
+    }
+    m_unitOptions = new Options(*m_options);
+    m_options = m_unitOptions;
+    m_kernel->setOptions(m_options);
+    m_builder->setOptions(m_options);
+}
+
 void VISAKernelImpl::CopyVars(VISAKernelImpl* from)
 {
     m_builder->dclpool.getDeclareList() = from->m_builder->dclpool.getDeclareList();
@@ -7846,6 +7863,7 @@ VISAKernelImpl::~VISAKernelImpl()
         m_builder->~IR_Builder();
         delete m_kernelMem;
     }
+    delete m_unitOptions;
 
     destroyKernelAttributes();
 }
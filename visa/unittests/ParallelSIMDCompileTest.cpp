@@ -0,0 +1,117 @@
+/*===================== begin_copyright_notice ==================================
+
+Copyright (c) 2021 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+======================= end_copyright_notice ==================================*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "visaBuilder_interface.h"
+#include "common.h"
+#include "TestKernels.h"
+
+#include "gtest/gtest.h"
+
+using namespace vISATest;
+
+namespace {
+
+// IGC compiles the SIMD variants of a shader with one vISA builder each and
+// may run their finalizers on worker threads (EnableParallelSIMDCompile).
+// Builders must not share state, so the binaries have to match a serial
+// compile. Sizes differ so that the finalizers overlap unevenly.
+struct Variant
+{
+    unsigned numInsts;
+    unsigned numVars;
+};
+const Variant variants[] = { { 1600, 80 }, { 2400, 88 }, { 3200, 96 } };
+
+struct Result
+{
+    std::vector<char> binary;
+    double ms = 0;
+};
+
+Result compileVariant(const Variant& v)
+{
+    Result r;
+    VISABuilder* vb = nullptr;
+    if (CreateVISABuilder(vb, vISA_DEFAULT, VISA_BUILDER_GEN, GENX_SKL, 0, nullptr, nullptr) != VISA_SUCCESS)
+    {
+        return r;
+    }
+    VISAKernel* k = nullptr;
+    vb->AddKernel(k, "madChain");
+    buildMadChain(k, v.numInsts, v.numVars);
+    k->AppendVISACFRetInst(nullptr, vISA_EMASK_M1, EXEC_SIZE_1);
+
+    auto start = std::chrono::steady_clock::now();
+    if (vb->Compile("") == VISA_SUCCESS)
+    {
+        r.binary = getBinary(k);
+    }
+    r.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    DestroyVISABuilder(vb);
+    return r;
+}
+
+TEST(ParallelSIMDCompile, ConcurrentBuildersMatchSerial)
+{
+    std::vector<Result> serial;
+    double slowest = 0, total = 0;
+    for (const Variant& v : variants)
+    {
+        serial.push_back(compileVariant(v));
+        ASSERT_FALSE(serial.back().binary.empty());
+        slowest = std::max(slowest, serial.back().ms);
+        total += serial.back().ms;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::future<Result>> pending;
+    for (const Variant& v : variants)
+    {
+        pending.push_back(std::async(std::launch::async, compileVariant, std::cref(v)));
+    }
+    std::vector<Result> parallel;
+    for (auto& f : pending)
+    {
+        parallel.push_back(f.get());
+    }
+    double wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    for (size_t i = 0; i < serial.size(); ++i)
+    {
+        EXPECT_EQ(serial[i].binary, parallel[i].binary) << "variant " << i;
+    }
+    printf("serial: slowest %.1f ms, total %.1f ms; concurrent wall %.1f ms (%u hw threads)\n",
+        slowest, total, wall, std::thread::hardware_concurrency());
+}
+
+} // namespace
@@ -0,0 +1,106 @@
+/*===================== begin_copyright_notice ==================================
+
+Copyright (c) 2021 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+======================= end_copyright_notice ==================================*/
+
+#include <vector>
+
+#include "visaBuilder_interface.h"
+#include "common.h"
+#include "TestKernels.h"
+
+#include "gtest/gtest.h"
+
+using namespace vISATest;
+
+namespace {
+
+// "-compileThreads N" compiles the kernels and functions of one builder on
+// worker threads. The result must be byte-identical to a serial compile,
+// including when RA of one unit falls back (K0 is a 3D kernel with a
+// subroutine, which turns off local RA for it) before units that do not.
+// F is stitched into K0, so comparing the kernels covers it too.
+std::vector<std::vector<char>> compileUnits(int argc, const char** argv)
+{
+    std::vector<std::vector<char>> binaries;
+    VISABuilder* vb = nullptr;
+    if (CreateVISABuilder(vb, vISA_DEFAULT, VISA_BUILDER_GEN, GENX_SKL, argc, argv, nullptr) != VISA_SUCCESS)
+    {
+        return binaries;
+    }
+
+    VISAKernel* k0 = nullptr;
+    vb->AddKernel(k0, "K0");
+    uint8_t target = VISA_3D;
+    k0->AddKernelAttribute("Target", 1, &target);
+    // like IGC, open the kernel body with a subroutine label so that
+    // K0_sub is recognized as a separate subroutine
+    VISA_LabelOpnd* main = nullptr;
+    k0->CreateVISALabelVar(main, "_main", LABEL_SUBROUTINE);
+    k0->AppendVISACFLabelInst(main);
+    buildMadChain(k0, 600, 40);
+    VISA_LabelOpnd* sub = nullptr;
+    k0->CreateVISALabelVar(sub, "K0_sub", LABEL_SUBROUTINE);
+    k0->AppendVISACFCallInst(nullptr, vISA_EMASK_M1, EXEC_SIZE_1, sub);
+    k0->AppendVISACFFunctionCallInst(nullptr, vISA_EMASK_M1, EXEC_SIZE_1, "F", 0, 0);
+    k0->AppendVISACFRetInst(nullptr, vISA_EMASK_M1, EXEC_SIZE_1);
+    k0->AppendVISACFLabelInst(sub);
+    k0->AppendVISACFRetInst(nullptr, vISA_EMASK_M1, EXEC_SIZE_1);
+
+    VISAKernel* k1 = nullptr;
+    vb->AddKernel(k1, "K1");
+    buildMadChain(k1, 200, 16);
+    k1->AppendVISACFRetInst(nullptr, vISA_EMASK_M1, EXEC_SIZE_1);
+
+    VISAFunction* f = nullptr;
+    vb->AddFunction(f, "F");
+    buildMadChain(f, 400, 24, false);
+    f->AppendVISACFFunctionRetInst(nullptr, vISA_EMASK_M1, EXEC_SIZE_1);
+
+    if (vb->Compile("") == VISA_SUCCESS)
+    {
+        binaries.push_back(getBinary(k0));
+        binaries.push_back(getBinary(k1));
+    }
+    DestroyVISABuilder(vb);
+    return binaries;
+}
+
+TEST(ParallelUnitCompile, MatchesSerial)
+{
+    std::vector<std::vector<char>> serial = compileUnits(0, nullptr);
+    ASSERT_EQ(serial.size(), 2u);
+
+    const char* args[] = { "-compileThreads", "4" };
+    std::vector<std::vector<char>> parallel = compileUnits(2, args);
+    ASSERT_EQ(parallel.size(), 2u);
+
+    for (size_t i = 0; i < serial.size(); ++i)
+    {
+        EXPECT_FALSE(serial[i].empty()) << "unit " << i;
+        EXPECT_EQ(serial[i], parallel[i]) << "unit " << i;
+    }
+}
+
+} // namespace
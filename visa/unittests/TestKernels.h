@@ -0,0 +1,109 @@
+/*===================== begin_copyright_notice ==================================
+
+Copyright (c) 2021 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+======================= end_copyright_notice ==================================*/
+
+// Kernels built through the vISA builder API for the unit tests.
+
+#ifndef _VISA_UNITTESTS_TESTKERNELS_H_
+#define _VISA_UNITTESTS_TESTKERNELS_H_
+
+#include <string>
+#include <vector>
+
+#include "visaBuilder_interface.h"
+
+namespace vISATest {
+
+// Append to k a straight-line chain of numInsts SIMD16 mads over numVars
+// float variables, followed by an A64 block store of every variable so that
+// nothing is dead. More instructions and variables mean more time in RA
+// and scheduling. The caller appends the return. Functions have no input
+// payload, so isKernel must be false for them.
+inline void buildMadChain(VISAKernel* k, unsigned numInsts, unsigned numVars, bool isKernel = true)
+{
+    VISA_GenVar* addr = nullptr;
+    VISA_GenVar* seed = nullptr;
+    k->CreateVISAGenVar(addr, "Addr", 1, ISA_TYPE_UQ, ALIGN_QWORD);
+    k->CreateVISAGenVar(seed, "Seed", 16, ISA_TYPE_F, ALIGN_GRF);
+    if (isKernel)
+    {
+        k->CreateVISAInputVar(addr, 32, 8);
+        k->CreateVISAInputVar(seed, 64, 64);
+    }
+
+    // every variable starts as a different multiple of the seed
+    std::vector<VISA_GenVar*> vars(numVars);
+    for (unsigned i = 0; i < numVars; ++i)
+    {
+        std::string name = "V" + std::to_string(i);
+        k->CreateVISAGenVar(vars[i], name.c_str(), 16, ISA_TYPE_F, ALIGN_GRF);
+        VISA_VectorOpnd* dst = nullptr;
+        VISA_VectorOpnd* src = nullptr;
+        VISA_VectorOpnd* imm = nullptr;
+        float scale = (float)(i + 1);
+        k->CreateVISADstOperand(dst, vars[i], 1, 0, 0);
+        k->CreateVISASrcOperand(src, seed, MODIFIER_NONE, 8, 8, 1, 0, 0);
+        k->CreateVISAImmediate(imm, &scale, ISA_TYPE_F);
+        k->AppendVISAArithmeticInst(ISA_MUL, nullptr, false, vISA_EMASK_M1, EXEC_SIZE_16,
+            dst, src, imm);
+    }
+
+    for (unsigned i = 0; i < numInsts; ++i)
+    {
+        VISA_VectorOpnd* dst = nullptr;
+        VISA_VectorOpnd* src0 = nullptr;
+        VISA_VectorOpnd* src1 = nullptr;
+        VISA_VectorOpnd* src2 = nullptr;
+        k->CreateVISADstOperand(dst, vars[i % numVars], 1, 0, 0);
+        k->CreateVISASrcOperand(src0, vars[(i * 7 + 1) % numVars], MODIFIER_NONE, 8, 8, 1, 0, 0);
+        k->CreateVISASrcOperand(src1, vars[(i * 3 + 2) % numVars], MODIFIER_NONE, 8, 8, 1, 0, 0);
+        k->CreateVISASrcOperand(src2, vars[(i + 5) % numVars], MODIFIER_NONE, 8, 8, 1, 0, 0);
+        k->AppendVISAArithmeticInst(ISA_MAD, nullptr, false, vISA_EMASK_M1, EXEC_SIZE_16,
+            dst, src0, src1, src2);
+    }
+
+    for (unsigned i = 0; i < numVars; ++i)
+    {
+        VISA_VectorOpnd* addrOpnd = nullptr;
+        VISA_RawOpnd* data = nullptr;
+        k->CreateVISASrcOperand(addrOpnd, addr, MODIFIER_NONE, 0, 1, 0, 0, 0);
+        k->CreateVISARawOperand(data, vars[i], 0);
+        k->AppendVISASvmBlockStoreInst(OWORD_NUM_4, false, addrOpnd, data);
+    }
+}
+
+// Copy of the Gen binary of a compiled kernel or function.
+inline std::vector<char> getBinary(VISAKernel* k)
+{
+    void* buf = nullptr;
+    int size = 0;
+    k->GetGenxBinary(buf, size);
+    const char* p = static_cast<const char*>(buf);
+    return std::vector<char>(p, p + size);
+}
+
+} // namespace vISATest
+
+#endif // _VISA_UNITTESTS_TESTKERNELS_H_